@@ -0,0 +1,139 @@
+#!/bin/bash
+
+##
+# This file provides a benchmark suite for the F4 implementation used in
+# parallelGBC. Each of the chosen inputs is computed with each number of
+# threads and each block size. The result is compared with the expected
+# result in gb/ and the runtime with the runtime stored in the baseline.
+# A run which is slower than the baseline by more than the tolerance is
+# flagged, unless the difference is below an absolute floor, since the
+# runtime of short runs is dominated by noise. The metrics of each
+# reduction step of the fastest run are written to the results directory.
+#
+# Usage: ./test/RunBenchmark.sh [baseline] [tolerance in %]
+#
+# The suite can be configured by the following environment variables:
+#
+# INPUTS  - The names of the inputs (default: some files of gb/)
+# THREADS - The numbers of threads (default: 1 2 4)
+# BLOCKS  - The block sizes (default: 256 1024)
+# REDUCER - The reducer (default: 0)
+# REPEAT  - The number of runs, the fastest run counts (default: 3)
+# RESULTS - The directory for the results (default: benchmark)
+# FLOOR   - Differences below this time (in s) are never flagged (default: 0.05)
+#
+# If the baseline does not exist, the results are stored as baseline. The
+# default baseline is $RESULTS/baseline.csv, as it depends on the machine.
+# To replace the baseline just delete it.
+#
+######
+#
+# parallelGBC is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# parallelGBC is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with parallelGBC.  If not, see <http://www.gnu.org/licenses/>.
+
+INPUTS=${INPUTS:-"cyclic6 eco7 katsura7 katsura8 rcyclic10 sym3_5 td-89 verschelde.gametwo5"}
+THREADS=${THREADS:-"1 2 4"}
+BLOCKS=${BLOCKS:-"256 1024"}
+REDUCER=${REDUCER:-0}
+REPEAT=${REPEAT:-3}
+RESULTS=${RESULTS:-benchmark}
+FLOOR=${FLOOR:-0.05}
+
+baseline=${1:-$RESULTS/baseline.csv}
+tolerance=${2:-10}
+
+# Message text if computation fails
+FAILED="\033[1;31mfailed\033[0m"
+# Message text if computation is slower than the baseline
+SLOWER="\033[1;33mslower\033[0m"
+# Message text if computation passes
+PASSED="\033[0;32mpassed\033[0m"
+
+# Counter for the number of executed, failed and slower runs
+ACOUNT=0;
+declare -i ACOUNT;
+FCOUNT=0;
+declare -i FCOUNT;
+SCOUNT=0;
+declare -i SCOUNT;
+
+mkdir -p $RESULTS
+results=$RESULTS/results.csv
+echo "input,reducer,threads,block,runtime" > $results
+
+echo -e "Benchmark of reducer ${REDUCER}, tolerance ${tolerance}% (at least ${FLOOR}s), results in ${RESULTS}/:\n"
+printf "%-28s %8s %8s %12s %12s %8s\n" "input" "threads" "block" "runtime (s)" "baseline" "status"
+for n in $INPUTS;
+do
+	for c in $THREADS;
+	do
+		for b in $BLOCKS;
+		do
+			ACOUNT=$ACOUNT+1;
+			best=""
+			status=$PASSED
+			metrics=$RESULTS/$n-$REDUCER-$c-$b.csv
+			for (( k = 0; k < REPEAT; k++ ));
+			do
+				# Print the runtime (verbosity 1) and the groebner basis, write the step metrics
+				out=$(./test/test-f4.bin input/$n.txt $c 1 1 $b 0 1 $REDUCER 32003 $metrics.run)
+				echo "$out" | tail -n 1 | diff -q - gb/$n.txt >> /dev/null || status=$FAILED
+				t=$(echo "$out" | awk -F'\t' '/^Runtime/ { print $2 }')
+				# Keep the metrics of the fastest run
+				if [ -z "$best" ] || awk -v a=$t -v b=$best 'BEGIN { exit !(a < b) }'
+				then
+					best=$t
+					mv $metrics.run $metrics
+				fi
+			done;
+			rm -f $metrics.run
+			echo "$n,$REDUCER,$c,$b,$best" >> $results
+			# Look up the runtime of the same run in the baseline
+			base=""
+			if [ -f "$baseline" ]
+			then
+				base=$(awk -F',' -v n=$n -v r=$REDUCER -v c=$c -v b=$b '$1 == n && $2 == r && $3 == c && $4 == b { print $5 }' $baseline)
+			fi
+			if [ "$status" == "$FAILED" ]
+			then
+				FCOUNT=$FCOUNT+1;
+			elif [ -n "$base" ] && awk -v a=$best -v b=$base -v t=$tolerance -v f=$FLOOR 'BEGIN { exit !(a > b * (1 + t / 100) && a - b > f) }'
+			then
+				status=$SLOWER
+				SCOUNT=$SCOUNT+1;
+			fi
+			printf "%-28s %8d %8d %12.3f %12s %8b\n" $n $c $b $best "${base:--}" "$status"
+		done;
+	done;
+done;
+
+if [ ! -f "$baseline" ]
+then
+	cp $results $baseline
+	echo -e "\nStored the results as baseline ${baseline}."
+fi
+
+# Print a statistic of the failed and the slower runs.
+if [ $FCOUNT -gt 0 ]
+then
+	echo -e "\n\033[1;31m${FCOUNT} of ${ACOUNT} runs failed, so something went wrong.\033[0m"
+fi
+if [ $SCOUNT -gt 0 ]
+then
+	echo -e "\n\033[1;33m${SCOUNT} of ${ACOUNT} runs are slower than the baseline.\033[0m"
+fi
+if [ $FCOUNT -eq 0 ] && [ $SCOUNT -eq 0 ]
+then
+	echo -e "\n\033[1;32mAll runs passed!\033[0m";
+fi
+[ $FCOUNT -eq 0 ] && [ $SCOUNT -eq 0 ]
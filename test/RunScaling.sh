@@ -0,0 +1,69 @@
+#!/bin/bash
+
+##
+# This file reports the scaling of the F4 implementation used in
+# parallelGBC. For all files in gb/ the script computes the groebner
+# basis of the matching file in input/ with 1, 2, 4, ... threads up to
+# the given number of threads and prints the runtime, the reduction time
+# and the speedup of both compared to one thread.
+#
+# Usage: ./test/RunScaling.sh [threads] [reducer] [block size]
+#
+######
+#
+# parallelGBC is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# parallelGBC is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with parallelGBC.  If not, see <http://www.gnu.org/licenses/>.
+
+# The largest number of threads, the reducer and the block size
+max=${1:-$(nproc)}
+r=${2:-0}
+b=${3:-1024}
+
+# The numbers of threads: The powers of two below max and max itself
+threads=""
+for (( c = 1; c < max; c *= 2 ));
+do
+	threads="$threads $c"
+done;
+threads="$threads $max"
+
+echo -e "Scaling of reducer ${r} with block size ${b} on \033[1;34m${max} core(s)\033[0m:\n"
+# More threads than processors do not measure the scaling, but only the overhead of the threads
+if [ $max -gt $(nproc) ]
+then
+	echo -e "\033[1;33mOnly $(nproc) processor(s) available, the runs with more threads are oversubscribed.\033[0m\n"
+fi
+printf "%-28s %8s %12s %12s %10s %10s\n" "input" "threads" "runtime (s)" "reduce (s)" "speedup" "reduce"
+# For all files in gb/ do ...
+for f in gb/*;
+do
+	# Set the path to the input file
+	i=input/${f##"gb/"};
+	t1=""
+	r1=""
+	for c in $threads;
+	do
+		# Run the computation, print the overall runtime (1) and the reduction time (2)
+		out=$(./test/test-f4.bin $i $c 3 0 $b 0 1 $r)
+		t=$(echo "$out" | awk -F'\t' '/^Runtime/ { print $2 }')
+		rt=$(echo "$out" | awk -F'\t' '/^Reduction/ { print $2 }')
+		if [ -z "$t1" ]
+		then
+			t1=$t
+			r1=$rt
+		fi
+		printf "%-28s %8d %12.3f %12.3f %10s %10s\n" "${f##"gb/"}" $c $t $rt \
+			$(awk -v a=$t1 -v b=$t 'BEGIN { printf "%.2f", (b > 0 ? a / b : 0) }') \
+			$(awk -v a=$r1 -v b=$rt 'BEGIN { printf "%.2f", (b > 0 ? a / b : 0) }')
+	done;
+done;
@@ -46,10 +46,13 @@ function passed() {
 	echo -e ${PASSED}
 }
 
+# For the default and the sparse reducer do ...
+for r in 0 1;
+	do
 # For 1 to 4 processors do ...
 for c in 1 2 4;
 	do
-	echo -e "\nRunning tests with \033[1;34m${c} core(s)\033[0m:"
+	echo -e "\nRunning tests with \033[1;34m${c} core(s)\033[0m and reducer ${r}:"
 	# For all files in gb/ do ...
 	for f in gb/*;
 	do
@@ -60,9 +63,69 @@ for c in 1 2 4;
 		# Output the input file name
 		echo -en "${f##"gb/"} ... ";
 		# Run the test
-		./test/test-f4.bin $i $c 0 1 | diff -q - $f >> /dev/null && passed || failed
+		./test/test-f4.bin $i $c 0 1 1024 0 1 $r | diff -q - $f >> /dev/null && passed || failed
 	done;
 done;
+done;
+
+# Compute each basis with the simplify strategies of the default reducer (1: F4Simplify, 2: F4SimplifyDB)
+for s in 1 2;
+	do
+	echo -e "\nRunning tests with \033[1;34m2 core(s)\033[0m and simplify ${s}:"
+	for f in gb/*;
+	do
+		ACOUNT=$ACOUNT+1;
+		i=input/${f##"gb/"};
+		echo -en "${f##"gb/"} ... ";
+		./test/test-f4.bin $i 2 0 1 1024 $s 1 0 | diff -q - $f >> /dev/null && passed || failed
+	done;
+done;
+
+# Compute each basis over F_{31981} by replaying the trace of the computation over F_{32003}. The
+# result has to match the direct computation over F_{31981} and the replay must not fall back
+# (31991 is unlucky for curve15_20, so its replay fails).
+for c in 1 2 4;
+	do
+	echo -e "\nRunning tests with \033[1;34m${c} core(s)\033[0m and trace replay:"
+	for f in gb/*;
+	do
+		ACOUNT=$ACOUNT+1;
+		i=input/${f##"gb/"};
+		echo -en "${f##"gb/"} ... ";
+		out=$(./test/test-f4.bin $i $c 1 1 1024 0 1 1 32003 "" 31981)
+		echo "$out" | grep -q $'^Replays:\t1 of 1$' && \
+			echo "$out" | grep -v ':' | diff -q - <(./test/test-f4.bin $i $c 0 1 1024 0 1 1 31981) >> /dev/null && passed || failed
+	done;
+done;
+
+# Compute each basis with a memory budget of 256 kB, so the large steps are split. The default
+# reducer has to keep the peak matrix size of all inputs within the budget, unless it reports
+# that a step didn't fit even with a single S-Polynomial (e.g. with larger coefficients). The
+# sparse reducer can't split its reduction polynomials.
+for r in 0 1;
+	do
+	echo -e "\nRunning tests with \033[1;34m2 core(s)\033[0m, reducer ${r} and a memory budget:"
+	for f in gb/*;
+	do
+		ACOUNT=$ACOUNT+1;
+		i=input/${f##"gb/"};
+		echo -en "${f##"gb/"} ... ";
+		out=$(./test/test-f4.bin $i 2 1 1 1024 0 1 $r 32003 "" "" 0.25)
+		peak=$(echo "$out" | grep $'^Peak matrix (kB):' | cut -f2)
+		over=$(echo "$out" | grep $'^Over budget (kB):' | cut -f2)
+		echo "$out" | grep -v ':' | diff -q - $f >> /dev/null && ( [ $r -ne 0 ] || [ $peak -le $((256 + over)) ] ) && passed || failed
+	done;
+done;
+
+# The budget must not change the result. Compute a larger basis, whose steps are split by the
+# budget of 256 kB, with and without budget.
+for r in 0 1;
+	do
+	echo -e "\nRunning tests with \033[1;34m2 core(s)\033[0m, reducer ${r} and a memory budget against no budget:"
+	ACOUNT=$ACOUNT+1;
+	echo -en "cyclic7.txt ... ";
+	./test/test-f4.bin input/cyclic7.txt 2 0 1 1024 0 1 $r 32003 "" "" 0.25 | diff -q - <(./test/test-f4.bin input/cyclic7.txt 2 0 1 1024 0 1 $r) >> /dev/null && passed || failed
+done;
 
 # If not all tests passed print a statistic how many tests failed.
 if [ $FCOUNT -gt 0 ]